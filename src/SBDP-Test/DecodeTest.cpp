@@ -6,6 +6,8 @@
  * @note    
  * Copyright (c) 2026 Satoh(3103lab.com)
  *****************************************************************************/
+#include <limits>
+
 #include "SBDP.h"
 #include "LightTest.h"
 
@@ -96,3 +98,119 @@ LTEST_DEFINE_TEST(TestDecodeFormatBinary)
     LTEST_EXPECT_EQ(decoded, expected);
 }
 
+LTEST_DEFINE_TEST(TestDecodeFormatMultipleEntries)
+{
+    const std::vector<uint8_t> encoded = {
+        0x00, 0x00, 0x00, 0x37,
+        0x00, 0x01, 0x69,
+        0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x01, 0x75,
+        0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x01, 0x66,
+        0x03,
+        0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0x73,
+        0x04,
+        0x00, 0x00, 0x00, 0x02,
+        0x61, 0x62,
+        0x00, 0x01, 0x62,
+        0x05,
+        0x00, 0x00, 0x00, 0x01,
+        0xFF
+    };
+
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+    const sbdp::Message expected = {
+        { "i", static_cast<int64_t>(1) },
+        { "u", static_cast<uint64_t>(2) },
+        { "f", static_cast<sbdp::float64_t>(1.0) },
+        { "s", std::string("ab") },
+        { "b", std::vector<uint8_t>{ 0xFF } }
+    };
+
+    LTEST_EXPECT_EQ(decoded.size(), expected.size());
+    LTEST_EXPECT_EQ(decoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestDecodeFormatEmpty)
+{
+    const std::vector<uint8_t> encoded = {
+        0x00, 0x00, 0x00, 0x00
+    };
+
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+
+    LTEST_EXPECT_EQ(decoded.size(), static_cast<size_t>(0));
+}
+
+LTEST_DEFINE_TEST(TestDecodeFormatMultiByteKey)
+{
+    const std::vector<uint8_t> encoded = {
+        0x00, 0x00, 0x00, 0x0F,
+        0x00, 0x04, 0x74, 0x79, 0x70, 0x65,
+        0x04,
+        0x00, 0x00, 0x00, 0x04,
+        0x70, 0x69, 0x6E, 0x67
+    };
+
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+    const sbdp::Message expected = {
+        { "type", std::string("ping") }
+    };
+
+    LTEST_EXPECT_EQ(decoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestDecodeFormatNumericRun)
+{
+    const std::vector<uint8_t> encoded = {
+        0x00, 0x00, 0x00, 0x30,
+        0x00, 0x01, 0x61,
+        0x01,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+        0x00, 0x01, 0x62,
+        0x02,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x00, 0x01, 0x63,
+        0x03,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0x64,
+        0x01,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+    const sbdp::Message expected = {
+        { "a", static_cast<int64_t>(-2) },
+        { "b", static_cast<uint64_t>(0x0102030405060708ULL) },
+        { "c", static_cast<sbdp::float64_t>(-2.0) },
+        { "d", std::numeric_limits<int64_t>::min() }
+    };
+
+    LTEST_EXPECT_EQ(decoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestDecodeFormatLongKey)
+{
+    // 256-byte key sets the high byte of the key length
+    const std::string strKey(256, 'k');
+
+    std::vector<uint8_t> encoded = {
+        0x00, 0x00, 0x01, 0x0B,
+        0x01, 0x00
+    };
+    encoded.insert(encoded.end(), strKey.begin(), strKey.end());
+    encoded.insert(encoded.end(), {
+        0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    });
+
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+    const sbdp::Message expected = {
+        { strKey, static_cast<int64_t>(1) }
+    };
+
+    LTEST_EXPECT_EQ(decoded, expected);
+}
@@ -91,4 +91,217 @@ LTEST_DEFINE_TEST(TestEncodeFormatBinary)
     LTEST_EXPECT_EQ(encoded, expected);
 }
 
+LTEST_DEFINE_TEST(TestEncodeFormatEmptyString)
+{
+    sbdp::Message msg{};
+    msg["k"] = std::string();
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x08,
+        0x00, 0x01, 0x6B,
+        0x04,
+        0x00, 0x00, 0x00, 0x00
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatEmptyBinary)
+{
+    sbdp::Message msg{};
+    msg["k"] = std::vector<uint8_t>{};
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x08,
+        0x00, 0x01, 0x6B,
+        0x05,
+        0x00, 0x00, 0x00, 0x00
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatEmptyMessage)
+{
+    const sbdp::Message msg{};
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x00
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeLengthPrefix)
+{
+    sbdp::Message msg{};
+    msg["int64"] = static_cast<int64_t>(-1);
+    msg["uint64"] = static_cast<uint64_t>(1);
+    msg["float64"] = static_cast<sbdp::float64_t>(0.5);
+    msg["string"] = std::string("hello sbdp");
+    msg["binary"] = std::vector<uint8_t>{ 0x00, 0x01, 0x02 };
+
+    // header(4) + per entry: key length(2) + key + tag(1) + payload
+    const size_t unFrameSize = 4
+        + (2 + 5 + 1 + 8)
+        + (2 + 6 + 1 + 8)
+        + (2 + 7 + 1 + 8)
+        + (2 + 6 + 1 + 4 + 10)
+        + (2 + 6 + 1 + 4 + 3);
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    LTEST_EXPECT_EQ(encoded.size(), unFrameSize);
+
+    const size_t unBodyLength =
+        (static_cast<size_t>(encoded[0]) << 24) |
+        (static_cast<size_t>(encoded[1]) << 16) |
+        (static_cast<size_t>(encoded[2]) << 8)  |
+        (static_cast<size_t>(encoded[3]));
+    LTEST_EXPECT_EQ(unBodyLength, unFrameSize - 4);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatMultiByteKey)
+{
+    sbdp::Message msg{};
+    msg["type"] = std::string("ping");
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x0F,
+        0x00, 0x04, 0x74, 0x79, 0x70, 0x65,
+        0x04,
+        0x00, 0x00, 0x00, 0x04,
+        0x70, 0x69, 0x6E, 0x67
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatUtf8Key)
+{
+    sbdp::Message msg{};
+    msg["\xE5\x80\xA4"] = static_cast<uint64_t>(1);
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x0E,
+        0x00, 0x03, 0xE5, 0x80, 0xA4,
+        0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    };
 
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatSmallInt64)
+{
+    sbdp::Message msg{};
+    msg["k"] = static_cast<int64_t>(-1);
+
+    // small values keep the fixed 8-byte representation by default
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x0C,
+        0x00, 0x01, 0x6B,
+        0x01,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatSmallUint64)
+{
+    sbdp::Message msg{};
+    msg["k"] = static_cast<uint64_t>(1);
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x00, 0x0C,
+        0x00, 0x01, 0x6B,
+        0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    };
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeStateless)
+{
+    sbdp::Message msg1{};
+    msg1["type"] = std::string("tick");
+    msg1["value"] = static_cast<int64_t>(1);
+
+    sbdp::Message msg2{};
+    msg2["type"] = std::string("tick");
+    msg2["value"] = static_cast<int64_t>(2);
+
+    // repeated keys must be spelled out in every frame
+    const std::vector<uint8_t> encoded1 = sbdp::EncodeMessage(msg1);
+    const std::vector<uint8_t> encoded2 = sbdp::EncodeMessage(msg2);
+    const std::vector<uint8_t> encoded1Again = sbdp::EncodeMessage(msg1);
+
+    LTEST_EXPECT_EQ(encoded1Again, encoded1);
+    LTEST_EXPECT_EQ(encoded2.size(), encoded1.size());
+    LTEST_EXPECT_TRUE(sbdp::DecodeMessage(encoded2) == msg2);
+    LTEST_EXPECT_TRUE(sbdp::DecodeMessage(encoded1Again) == msg1);
+}
+
+LTEST_DEFINE_TEST(TestEncodeLargeStringRaw)
+{
+    // highly compressible payload is still written as-is by default
+    std::string strLog{};
+    while (strLog.size() < 64 * 1024) {
+        strLog += "2026-01-01T00:00:00Z INFO sbdp: heartbeat ok\n";
+    }
+
+    sbdp::Message msg{};
+    msg["k"] = strLog;
+
+    const size_t unBodyLength = 2 + 1 + 1 + 4 + strLog.size();
+    const size_t unValueLength = strLog.size();
+
+    std::vector<uint8_t> expected = {
+        static_cast<uint8_t>(unBodyLength >> 24),
+        static_cast<uint8_t>(unBodyLength >> 16),
+        static_cast<uint8_t>(unBodyLength >> 8),
+        static_cast<uint8_t>(unBodyLength),
+        0x00, 0x01, 0x6B,
+        0x04,
+        static_cast<uint8_t>(unValueLength >> 24),
+        static_cast<uint8_t>(unValueLength >> 16),
+        static_cast<uint8_t>(unValueLength >> 8),
+        static_cast<uint8_t>(unValueLength)
+    };
+    expected.insert(expected.end(), strLog.begin(), strLog.end());
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
+
+LTEST_DEFINE_TEST(TestEncodeFormatLongKey)
+{
+    // 256-byte key sets the high byte of the key length
+    const std::string strKey(256, 'k');
+
+    sbdp::Message msg{};
+    msg[strKey] = static_cast<int64_t>(1);
+
+    std::vector<uint8_t> expected = {
+        0x00, 0x00, 0x01, 0x0B,
+        0x01, 0x00
+    };
+    expected.insert(expected.end(), strKey.begin(), strKey.end());
+    expected.insert(expected.end(), {
+        0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    });
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+
+    LTEST_EXPECT_EQ(encoded, expected);
+}
@@ -0,0 +1,88 @@
+﻿// SPDX-License-Identifier: LicenseRef-SBPD-1.0
+/******************************************************************************
+ * @file    MessageTest.cpp
+ * @brief   SimpleBinaryDictionaryProtocol Message Test
+ * @author  Satoh
+ * @note    
+ * Copyright (c) 2026 Satoh(3103lab.com)
+ *****************************************************************************/
+#include <string>
+#include <vector>
+
+#include "SBDP.h"
+#include "LightTest.h"
+
+LTEST_DEFINE_TEST(TestMessageOverwrite)
+{
+    sbdp::Message msg{};
+    msg["k"] = static_cast<int64_t>(1);
+    msg["k"] = std::string("v");
+
+    const sbdp::Message expected = {
+        { "k", std::string("v") }
+    };
+
+    LTEST_EXPECT_EQ(msg.size(), static_cast<size_t>(1));
+    LTEST_EXPECT_EQ(msg, expected);
+}
+
+LTEST_DEFINE_TEST(TestMessageInsertionOrder)
+{
+    sbdp::Message msg1{};
+    msg1["a"] = static_cast<int64_t>(1);
+    msg1["b"] = static_cast<uint64_t>(2);
+    msg1["c"] = std::string("3");
+
+    sbdp::Message msg2{};
+    msg2["c"] = std::string("3");
+    msg2["a"] = static_cast<int64_t>(1);
+    msg2["b"] = static_cast<uint64_t>(2);
+
+    LTEST_EXPECT_TRUE(msg1 == msg2);
+    LTEST_EXPECT_TRUE(sbdp::DecodeMessage(sbdp::EncodeMessage(msg2)) == msg1);
+}
+
+LTEST_DEFINE_TEST(TestMessageInequality)
+{
+    sbdp::Message msg{};
+    msg["k"] = static_cast<int64_t>(1);
+
+    // same numeric value, different type tag
+    sbdp::Message msgOtherType{};
+    msgOtherType["k"] = static_cast<uint64_t>(1);
+
+    sbdp::Message msgOtherKey{};
+    msgOtherKey["K"] = static_cast<int64_t>(1);
+
+    sbdp::Message msgOtherValue{};
+    msgOtherValue["k"] = static_cast<int64_t>(2);
+
+    sbdp::Message msgExtraKey{};
+    msgExtraKey["k"] = static_cast<int64_t>(1);
+    msgExtraKey["l"] = static_cast<int64_t>(1);
+
+    LTEST_EXPECT_FALSE(msg == msgOtherType);
+    LTEST_EXPECT_FALSE(msg == msgOtherKey);
+    LTEST_EXPECT_FALSE(msg == msgOtherValue);
+    LTEST_EXPECT_FALSE(msg == msgExtraKey);
+}
+
+LTEST_DEFINE_TEST(TestMessageIterationOrder)
+{
+    sbdp::Message msg{};
+    msg["type"] = std::string("tick");
+    msg["b"] = static_cast<int64_t>(2);
+    msg["value"] = static_cast<uint64_t>(3);
+    msg["a"] = static_cast<int64_t>(1);
+    msg["ts"] = static_cast<sbdp::float64_t>(4.0);
+
+    // iteration follows key order, not insertion order
+    std::vector<std::string> vecKeys{};
+    for (const auto& entry : msg) {
+        vecKeys.push_back(entry.first);
+    }
+    const std::vector<std::string> vecExpectedKeys = { "a", "b", "ts", "type", "value" };
+
+    LTEST_EXPECT_EQ(vecKeys.size(), msg.size());
+    LTEST_EXPECT_TRUE(vecKeys == vecExpectedKeys);
+}
@@ -6,6 +6,8 @@
  * @note    
  * Copyright (c) 2026 Satoh(3103lab.com)
  *****************************************************************************/
+#include <limits>
+
 #include "SBDP.h"
 #include "LightTest.h"
 
@@ -56,3 +58,102 @@ LTEST_DEFINE_TEST(TestDecodeMalformedMessage)
     LTEST_EXPECT_TRUE(thrown_appended);
 }
 
+
+LTEST_DEFINE_TEST(TestDecodeMalformedLength)
+{
+    // key length runs past the end of the frame
+    const std::vector<uint8_t> encoded_key_overrun = {
+        0x00, 0x00, 0x00, 0x04,
+        0x00, 0x08, 0x6B,
+        0x01
+    };
+
+    bool thrown_key_overrun = false;
+    try {
+        (void)sbdp::DecodeMessage(encoded_key_overrun);
+    }
+    catch (const std::runtime_error&) {
+        thrown_key_overrun = true;
+    }
+
+    // string length runs past the end of the frame
+    const std::vector<uint8_t> encoded_value_overrun = {
+        0x00, 0x00, 0x00, 0x0B,
+        0x00, 0x01, 0x6B,
+        0x04,
+        0x00, 0x00, 0x00, 0x10,
+        0x61, 0x62, 0x63
+    };
+
+    bool thrown_value_overrun = false;
+    try {
+        (void)sbdp::DecodeMessage(encoded_value_overrun);
+    }
+    catch (const std::runtime_error&) {
+        thrown_value_overrun = true;
+    }
+
+    // frame shorter than the length header
+    const std::vector<uint8_t> encoded_short_header = {
+        0x00, 0x00, 0x00
+    };
+
+    bool thrown_short_header = false;
+    try {
+        (void)sbdp::DecodeMessage(encoded_short_header);
+    }
+    catch (const std::runtime_error&) {
+        thrown_short_header = true;
+    }
+
+    LTEST_EXPECT_TRUE(thrown_key_overrun);
+    LTEST_EXPECT_TRUE(thrown_value_overrun);
+    LTEST_EXPECT_TRUE(thrown_short_header);
+}
+
+LTEST_DEFINE_TEST(TestRoundTripNumericLimits)
+{
+    sbdp::Message msg{};
+    msg["int64_min"] = std::numeric_limits<int64_t>::min();
+    msg["int64_max"] = std::numeric_limits<int64_t>::max();
+    msg["int64_zero"] = static_cast<int64_t>(0);
+    msg["int64_minus_one"] = static_cast<int64_t>(-1);
+    msg["uint64_max"] = std::numeric_limits<uint64_t>::max();
+    msg["uint64_zero"] = static_cast<uint64_t>(0);
+    msg["float64_max"] = std::numeric_limits<sbdp::float64_t>::max();
+    msg["float64_lowest"] = std::numeric_limits<sbdp::float64_t>::lowest();
+    msg["float64_denorm"] = std::numeric_limits<sbdp::float64_t>::denorm_min();
+    msg["float64_inf"] = std::numeric_limits<sbdp::float64_t>::infinity();
+    msg["float64_minus_inf"] = -std::numeric_limits<sbdp::float64_t>::infinity();
+
+    const std::vector<uint8_t> encoded = sbdp::EncodeMessage(msg);
+    const sbdp::Message decoded = sbdp::DecodeMessage(encoded);
+
+    LTEST_EXPECT_EQ(decoded.size(), msg.size());
+    LTEST_EXPECT_TRUE(decoded == msg);
+}
+
+LTEST_DEFINE_TEST(TestDecodeUnknownTypeTag)
+{
+    // tags 0x01-0x05 are the only defined value types
+    const std::vector<uint8_t> tags = { 0x00, 0x06, 0x7F, 0xFF };
+
+    size_t unRejectedCount = 0;
+    for (const uint8_t tag : tags) {
+        const std::vector<uint8_t> encoded = {
+            0x00, 0x00, 0x00, 0x0C,
+            0x00, 0x01, 0x6B,
+            tag,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+        };
+
+        try {
+            (void)sbdp::DecodeMessage(encoded);
+        }
+        catch (const std::runtime_error&) {
+            unRejectedCount++;
+        }
+    }
+
+    LTEST_EXPECT_EQ(unRejectedCount, tags.size());
+}
@@ -7,11 +7,14 @@
  * Copyright (c) 2026 Satoh(3103lab.com)
  *****************************************************************************/
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <string>
 #include <thread>
+#include <variant>
+#include <vector>
 
 #include "SBDP.h"
 #include "SBDPSocket.h"
@@ -25,6 +28,41 @@ unsigned short NextTestPort()
     return s_unPort.fetch_add(1);
 }
 
+// sends every message over one new connection and returns what the peer received
+std::vector<sbdp::Message> SendAllAndReceive(const std::vector<sbdp::Message>& vecMessages)
+{
+    const unsigned short unPort = NextTestPort();
+    std::atomic<bool> bServerReady{false};
+    std::vector<sbdp::Message> vecReceived{};
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        for (size_t i = 0; i < vecMessages.size(); ++i) {
+            vecReceived.push_back(cClient.RecvMessage(1000));
+        }
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+    for (const auto& msg : vecMessages) {
+        LTEST_EXPECT_TRUE(cClient.SendMessage(msg));
+    }
+
+    thServer.join();
+    return vecReceived;
+}
+
 } // namespace
 
 LTEST_DEFINE_TEST(TestSocketSendRecvNormal)
@@ -366,3 +404,606 @@ LTEST_DEFINE_TEST(TestSocketRecvClientShutdown)
 
     sbdp::CleanupSockets();
 }
+
+LTEST_DEFINE_TEST(TestSocketSendRecvLargeMessage)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    std::atomic<bool> bServerReady{false};
+    sbdp::Message msgServerReceivedLarge{};
+    sbdp::Message msgServerReceivedSmall{};
+
+    // 256KiB body arrives over several recv() calls
+    std::string strLarge(256 * 1024, '\0');
+    for (size_t i = 0; i < strLarge.size(); ++i) {
+        strLarge[i] = static_cast<char>('a' + (i % 26));
+    }
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        msgServerReceivedLarge = cClient.RecvMessage(1000);
+        msgServerReceivedSmall = cClient.RecvMessage(1000);
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+
+    sbdp::Message msgLarge{};
+    msgLarge["type"] = std::string("large");
+    msgLarge["body"] = strLarge;
+    LTEST_EXPECT_TRUE(cClient.SendMessage(msgLarge));
+
+    sbdp::Message msgSmall{};
+    msgSmall["type"] = std::string("small");
+    LTEST_EXPECT_TRUE(cClient.SendMessage(msgSmall));
+
+    thServer.join();
+
+    LTEST_EXPECT_EQ(msgServerReceivedLarge, msgLarge);
+    LTEST_EXPECT_EQ(msgServerReceivedSmall, msgSmall);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketRecvBurst)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    const int64_t snBurstCount = 100;
+    std::atomic<bool> bServerReady{false};
+    std::atomic<bool> bServerSent{false};
+    std::atomic<bool> bClientDone{false};
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        for (int64_t i = 0; i < snBurstCount; ++i) {
+            sbdp::Message msgTick{};
+            msgTick["seq"] = i;
+            LTEST_EXPECT_TRUE(cClient.SendMessage(msgTick));
+        }
+        bServerSent = true;
+
+        // keep the connection open until the client has seen the timeout
+        while (!bClientDone.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        cClient.Close();
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+
+    // let the whole burst land in the kernel buffer before reading
+    while (!bServerSent.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    int64_t snReceived = 0;
+    for (int64_t i = 0; i < snBurstCount; ++i) {
+        sbdp::Message msgExpected{};
+        msgExpected["seq"] = i;
+        const sbdp::Message msgReceived = cClient.RecvMessage(1000);
+        if (msgReceived == msgExpected) {
+            snReceived++;
+        }
+    }
+
+    bool bTimedOut = false;
+    try {
+        (void)cClient.RecvMessage(50);
+    }
+    catch (const std::system_error& e) {
+        bTimedOut = (e.code() == std::errc::timed_out);
+    }
+    catch (...) {
+        bTimedOut = false;
+    }
+    bClientDone = true;
+
+    thServer.join();
+    LTEST_EXPECT_EQ(snReceived, snBurstCount);
+    LTEST_EXPECT_TRUE(bTimedOut);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketSendBurstMixed)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    // small messages interleaved with large BINARY payloads
+    std::vector<sbdp::Message> vecMessages{};
+    for (int64_t i = 0; i < 16; ++i) {
+        sbdp::Message msg{};
+        msg["seq"] = i;
+        if ((i % 4) == 3) {
+            msg["payload"] = std::vector<uint8_t>(64 * 1024, static_cast<uint8_t>(i));
+        }
+        vecMessages.push_back(std::move(msg));
+    }
+    const std::vector<sbdp::Message> vecReceived = SendAllAndReceive(vecMessages);
+
+    LTEST_EXPECT_EQ(vecReceived.size(), vecMessages.size());
+    LTEST_EXPECT_TRUE(vecReceived == vecMessages);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketMultipleClients)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    const int64_t snClientCount = 8;
+    std::atomic<bool> bServerReady{false};
+    std::atomic<int64_t> snConnected{0};
+    std::atomic<int64_t> snSent{0};
+    std::atomic<int64_t> snAcked{0};
+    int64_t snReplied = 0;
+
+    sbdp::Socket cListen{};
+    std::thread thServer([&]() {
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        // hold every connection open before serving any of them
+        std::vector<sbdp::Socket> vecConnections{};
+        for (int64_t i = 0; i < snClientCount; ++i) {
+            vecConnections.push_back(cListen.Accept());
+        }
+
+        std::vector<sbdp::Message> vecRequests{};
+        for (auto& cConnection : vecConnections) {
+            vecRequests.push_back(cConnection.RecvMessage(5000));
+        }
+
+        // reply in reverse order so each ack must find its own connection
+        for (size_t i = vecConnections.size(); i > 0; --i) {
+            sbdp::Message msgReply = vecRequests[i - 1];
+            msgReply["type"] = std::string("ack");
+            if (vecConnections[i - 1].SendMessage(msgReply)) {
+                snReplied++;
+            }
+        }
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // client threads only count results; checks run on this thread after join
+    std::vector<std::thread> vecClients{};
+    for (int64_t i = 0; i < snClientCount; ++i) {
+        vecClients.emplace_back([&, i]() {
+            sbdp::Socket cClient{};
+            if (!cClient.Create() || !cClient.Connect("127.0.0.1", unPort)) {
+                return;
+            }
+            snConnected++;
+
+            sbdp::Message msgSend{};
+            msgSend["type"] = std::string("hello");
+            msgSend["id"] = i;
+            if (cClient.SendMessage(msgSend)) {
+                snSent++;
+            }
+
+            sbdp::Message msgExpectedReply{};
+            msgExpectedReply["type"] = std::string("ack");
+            msgExpectedReply["id"] = i;
+            if (cClient.RecvMessage(5000) == msgExpectedReply) {
+                snAcked++;
+            }
+        });
+    }
+    for (auto& thClient : vecClients) {
+        thClient.join();
+    }
+
+    thServer.join();
+    cListen.Close();
+    LTEST_EXPECT_EQ(snConnected.load(), snClientCount);
+    LTEST_EXPECT_EQ(snSent.load(), snClientCount);
+    LTEST_EXPECT_EQ(snReplied, snClientCount);
+    LTEST_EXPECT_EQ(snAcked.load(), snClientCount);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketRecvAfterTimeout)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    std::atomic<bool> bServerReady{false};
+    std::atomic<bool> bClientTimedOut{false};
+
+    sbdp::Message msgSend{};
+    msgSend["type"] = std::string("late");
+    msgSend["value"] = static_cast<int64_t>(7);
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        while (!bClientTimedOut.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        LTEST_EXPECT_TRUE(cClient.SendMessage(msgSend));
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        cClient.Close();
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+
+    bool bTimedOut = false;
+    try {
+        (void)cClient.RecvMessage(50);
+    }
+    catch (const std::system_error& e) {
+        bTimedOut = (e.code() == std::errc::timed_out);
+    }
+    catch (...) {
+        bTimedOut = false;
+    }
+    bClientTimedOut = true;
+
+    // a timeout must leave the connection usable
+    const sbdp::Message msgReceived = cClient.RecvMessage(1000);
+
+    thServer.join();
+    LTEST_EXPECT_TRUE(bTimedOut);
+    LTEST_EXPECT_EQ(msgReceived, msgSend);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketPipelinedRequests)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    const int64_t snRequestCount = 32;
+    std::atomic<bool> bServerReady{false};
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        for (int64_t i = 0; i < snRequestCount; ++i) {
+            sbdp::Message msgReply = cClient.RecvMessage(1000);
+            msgReply["type"] = std::string("ack");
+            LTEST_EXPECT_TRUE(cClient.SendMessage(msgReply));
+        }
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+
+    // all requests go out before the first reply is read
+    for (int64_t i = 0; i < snRequestCount; ++i) {
+        sbdp::Message msgRequest{};
+        msgRequest["type"] = std::string("ping");
+        msgRequest["seq"] = i;
+        LTEST_EXPECT_TRUE(cClient.SendMessage(msgRequest));
+    }
+
+    int64_t snMatched = 0;
+    for (int64_t i = 0; i < snRequestCount; ++i) {
+        sbdp::Message msgExpectedReply{};
+        msgExpectedReply["type"] = std::string("ack");
+        msgExpectedReply["seq"] = i;
+        if (cClient.RecvMessage(1000) == msgExpectedReply) {
+            snMatched++;
+        }
+    }
+
+    thServer.join();
+    LTEST_EXPECT_EQ(snMatched, snRequestCount);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketSendRecvAfterClose)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    std::atomic<bool> bServerReady{false};
+    std::atomic<bool> bClientDone{false};
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        while (!bClientDone.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        cClient.Close();
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+    cClient.Close();
+
+    sbdp::Message msg{};
+    msg["k"] = std::string("v");
+
+    bool bSendThrown = false;
+    try {
+        (void)cClient.SendMessage(msg);
+    }
+    catch (const std::system_error&) {
+        bSendThrown = true;
+    }
+    catch (...) {
+        bSendThrown = true;
+    }
+
+    // a closed socket must fail well before the timeout rather than block
+    bool bRecvFailed = false;
+    const auto tmRecvBegin = std::chrono::steady_clock::now();
+    try {
+        (void)cClient.RecvMessage(1000);
+    }
+    catch (const std::exception&) {
+        bRecvFailed = true;
+    }
+    const auto tmRecvElapsed = std::chrono::steady_clock::now() - tmRecvBegin;
+    bClientDone = true;
+
+    thServer.join();
+    LTEST_EXPECT_TRUE(bSendThrown);
+    LTEST_EXPECT_TRUE(bRecvFailed);
+    LTEST_EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(tmRecvElapsed).count(), 500);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketRecvShapeChange)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    // consecutive frames on one connection must not leak entries into each other
+    std::vector<sbdp::Message> vecMessages{};
+    // same shape, values grow and shrink
+    for (int64_t i = 0; i < 4; ++i) {
+        sbdp::Message msg{};
+        msg["type"] = std::string("tick");
+        msg["value"] = i;
+        msg["name"] = std::string(static_cast<size_t>((i % 2) ? 64 : 1), 'x');
+        msg["raw"] = std::vector<uint8_t>(static_cast<size_t>((i % 2) ? 1 : 64), static_cast<uint8_t>(i));
+        vecMessages.push_back(std::move(msg));
+    }
+    // fewer keys than the previous message
+    {
+        sbdp::Message msg{};
+        msg["type"] = std::string("tick");
+        vecMessages.push_back(std::move(msg));
+    }
+    // same key, different value type
+    {
+        sbdp::Message msg{};
+        msg["type"] = static_cast<uint64_t>(1);
+        msg["value"] = std::string("1");
+        vecMessages.push_back(std::move(msg));
+    }
+
+    const std::vector<sbdp::Message> vecReceived = SendAllAndReceive(vecMessages);
+
+    LTEST_EXPECT_EQ(vecReceived.size(), vecMessages.size());
+    LTEST_EXPECT_TRUE(vecReceived == vecMessages);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketRecvRepeatedMessage)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    sbdp::Message msgState{};
+    for (int64_t i = 0; i < 30; ++i) {
+        msgState["field" + std::to_string(i)] = i;
+    }
+    sbdp::Message msgChanged = msgState;
+    msgChanged["field7"] = std::string("changed");
+
+    // unchanged, unchanged, one field changed, back to the original
+    const std::vector<sbdp::Message> vecMessages = { msgState, msgState, msgChanged, msgState };
+    const std::vector<sbdp::Message> vecReceived = SendAllAndReceive(vecMessages);
+
+    LTEST_EXPECT_EQ(vecReceived.size(), vecMessages.size());
+    LTEST_EXPECT_TRUE(vecReceived == vecMessages);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketSendLargeBinaryReuseBuffer)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    std::atomic<bool> bServerReady{false};
+    sbdp::Message msgServerReceived{};
+
+    std::vector<uint8_t> vecPayload(4 * 1024 * 1024);
+    for (size_t i = 0; i < vecPayload.size(); ++i) {
+        vecPayload[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    std::thread thServer([&]() {
+        sbdp::Socket cListen{};
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        sbdp::Socket cClient = cListen.Accept();
+        msgServerReceived = cClient.RecvMessage(5000);
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    sbdp::Socket cClient{};
+    LTEST_EXPECT_TRUE(cClient.Create());
+    LTEST_EXPECT_TRUE(cClient.Connect("127.0.0.1", unPort));
+
+    sbdp::Message msgSend{};
+    msgSend["type"] = std::string("chunk");
+    msgSend["data"] = vecPayload;
+    const sbdp::Message msgExpected = msgSend;
+
+    LTEST_EXPECT_TRUE(cClient.SendMessage(msgSend));
+    // once SendMessage returns the caller owns the payload storage again
+    auto& vecData = std::get<std::vector<uint8_t>>(msgSend["data"]);
+    std::fill(vecData.begin(), vecData.end(), static_cast<uint8_t>(0x00));
+
+    thServer.join();
+
+    LTEST_EXPECT_TRUE(msgServerReceived == msgExpected);
+
+    sbdp::CleanupSockets();
+}
+
+LTEST_DEFINE_TEST(TestSocketFanOutSameMessage)
+{
+    LTEST_EXPECT_TRUE(sbdp::InitSockets());
+
+    const unsigned short unPort = NextTestPort();
+    const int64_t snSubscriberCount = 8;
+    std::atomic<bool> bServerReady{false};
+    std::atomic<int64_t> snConnected{0};
+    std::atomic<int64_t> snMatched{0};
+    std::atomic<int64_t> snAckSent{0};
+    int64_t snPublished = 0;
+    int64_t snAckReceived = 0;
+
+    sbdp::Message msgPublish{};
+    msgPublish["topic"] = std::string("quotes");
+    msgPublish["seq"] = static_cast<uint64_t>(1);
+    msgPublish["payload"] = std::vector<uint8_t>(64 * 1024, 0x5A);
+    const sbdp::Message msgExpected = msgPublish;
+
+    const sbdp::Message msgAck = {
+        { "type", std::string("ack") }
+    };
+
+    sbdp::Socket cListen{};
+    std::thread thServer([&]() {
+        LTEST_EXPECT_TRUE(cListen.Create());
+        LTEST_EXPECT_TRUE(cListen.Bind(unPort));
+        LTEST_EXPECT_TRUE(cListen.Listen());
+        bServerReady = true;
+
+        // every subscriber is connected before anything is published
+        std::vector<sbdp::Socket> vecSubscribers{};
+        for (int64_t i = 0; i < snSubscriberCount; ++i) {
+            vecSubscribers.push_back(cListen.Accept());
+        }
+
+        // the same Message instance goes to every subscriber
+        for (auto& cSubscriber : vecSubscribers) {
+            if (cSubscriber.SendMessage(msgPublish)) {
+                snPublished++;
+            }
+        }
+        for (auto& cSubscriber : vecSubscribers) {
+            if (cSubscriber.RecvMessage(5000) == msgAck) {
+                snAckReceived++;
+            }
+        }
+    });
+
+    while (!bServerReady.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // subscriber threads only count results; checks run on this thread after join
+    std::vector<std::thread> vecSubscribers{};
+    for (int64_t i = 0; i < snSubscriberCount; ++i) {
+        vecSubscribers.emplace_back([&]() {
+            sbdp::Socket cClient{};
+            if (!cClient.Create() || !cClient.Connect("127.0.0.1", unPort)) {
+                return;
+            }
+            snConnected++;
+
+            if (cClient.RecvMessage(5000) == msgExpected) {
+                snMatched++;
+            }
+            if (cClient.SendMessage(msgAck)) {
+                snAckSent++;
+            }
+        });
+    }
+    for (auto& thSubscriber : vecSubscribers) {
+        thSubscriber.join();
+    }
+
+    thServer.join();
+    cListen.Close();
+    LTEST_EXPECT_EQ(snConnected.load(), snSubscriberCount);
+    LTEST_EXPECT_EQ(snPublished, snSubscriberCount);
+    LTEST_EXPECT_EQ(snMatched.load(), snSubscriberCount);
+    LTEST_EXPECT_EQ(snAckSent.load(), snSubscriberCount);
+    LTEST_EXPECT_EQ(snAckReceived, snSubscriberCount);
+    LTEST_EXPECT_TRUE(msgPublish == msgExpected);
+
+    sbdp::CleanupSockets();
+}